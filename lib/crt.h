@@ -7,6 +7,9 @@
 #include <stdio.h>
 #include <time.h>
 #include <threads.h>
+#ifndef _WIN32
+#include <unistd.h>
+#endif
 
 typedef char Char;
 typedef short Short;
@@ -33,3 +36,12 @@ static const int TimeUTC = TIME_UTC;
 static const int MutexPlain = mtx_plain;
 static const int MutexRecursive = mtx_recursive;
 static const int MutexTimed = mtx_timed;
+
+#ifndef _WIN32
+static const int SysconfProcessorCount = _SC_NPROCESSORS_ONLN;
+static const int ClockMonotonic = CLOCK_MONOTONIC;
+#else
+// From windows.h, which is far too large to include here.
+int QueryPerformanceCounter(LongLong* count);
+int QueryPerformanceFrequency(LongLong* frequency);
+#endif